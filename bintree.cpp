@@ -18,32 +18,73 @@ using namespace std;
 /*
  * Overloads the cout operator to output the contents of
  * the BST using inorder traversal.
+ * Keys are formatted into a buffer that is written in large chunks.
  * Ex. "and eee ff iii not"
  */
 std::ostream& operator<<(std::ostream &outStream, const BinTree &b)
+{
+    b.displayInorder(outStream);
+    outStream << endl;
+    return outStream;
+}
+
+/*
+ * Outputs the keys inorder, each followed by a space, without the
+ * trailing endl that operator<< adds. Lets several trees' keys be
+ * written onto one line.
+ */
+void BinTree::displayInorder(std::ostream &outStream) const
 {
     // Handle empty tree
-    if(b.root != nullptr)
+    if(root != nullptr)
     {
-        b.coutHelper(outStream, b.root);
+        string &buffer = renderBuffer();
+        coutHelper(root, buffer, outStream);
+        writeBuffer(buffer, outStream, 0);
     }
-    outStream << endl;
-    return outStream;
 }
 
 /*
- * Helper function for the cout operator. Recursively passes the ostream object.
+ * Helper function for the cout operator. Recursively appends each
+ * key and its separator to the buffer, writing it out when full.
  */
-void BinTree::coutHelper(std::ostream &outStream, const BinTree::Node *current) const
+void BinTree::coutHelper(const BinTree::Node *current, std::string &buffer, std::ostream &outStream) const
 {
     if(current->left != nullptr)
     {
-        coutHelper(outStream, current->left);
+        coutHelper(current->left, buffer, outStream);
     }
-    outStream << *current->data << " ";
+    buffer += current->data->getData();
+    buffer += ' ';
+    writeBuffer(buffer, outStream, RENDER_CHUNK);
     if(current->right != nullptr)
     {
-        coutHelper(outStream, current->right);
+        coutHelper(current->right, buffer, outStream);
+    }
+}
+
+/*
+ * Returns this thread's rendering buffer, emptied. The buffer keeps
+ * its capacity between calls so rendering does not allocate once warm.
+ */
+std::string &BinTree::renderBuffer()
+{
+    static thread_local string buffer;
+    buffer.clear();
+    buffer.reserve(RENDER_CHUNK + RENDER_CHUNK / 4);
+    return buffer;
+}
+
+/*
+ * Writes the buffer to the stream and empties it once it holds
+ * at least limit characters. A limit of 0 writes whatever is left.
+ */
+void BinTree::writeBuffer(std::string &buffer, std::ostream &outStream, size_t limit)
+{
+    if(!buffer.empty() && buffer.size() >= limit)
+    {
+        outStream.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        buffer.clear();
     }
 }
 
@@ -126,6 +167,16 @@ BinTree::~BinTree()
 void BinTree::bstreeToArray(NodeData *arr[])
 {
     int index = 0;
+    bstreeToArray(arr, index);
+}
+
+/*
+ * Populates an array from a BST starting at arr[index] and leaves
+ * index one past the last item added. Lets several trees be
+ * appended to the same array. Leaves the tree empty.
+ */
+void BinTree::bstreeToArray(NodeData *arr[], int &index)
+{
     inorderHelper(root, index, arr);
     makeEmpty();
 }
@@ -392,6 +443,122 @@ int BinTree::heightHelper(const Node* current) const
     return (1 + max(heightHelper(current->left), heightHelper(current->right)) );
 }
 
+/*
+ * Stores pointers to every key that starts with prefix in arr, in
+ * sorted order, and returns how many were stored. At most size
+ * pointers are stored. The pointers point to the actual objects in
+ * the tree, which keeps ownership of them.
+ * Only subtrees that can hold a matching key are visited, so this
+ * takes O(height + number of matches).
+ */
+int BinTree::prefixRange(const NodeData &prefix, NodeData *arr[], int size) const
+{
+    int index = 0;
+    prefixHelper(root, prefix.getData(), arr, size, index);
+    return index;
+}
+
+/*
+ * Helper function for prefixRange.
+ * Keys starting with prefix form one contiguous range, so a key
+ * before the range only needs its right subtree checked and a key
+ * after it only needs its left subtree checked.
+ */
+void BinTree::prefixHelper(const BinTree::Node *current, const std::string &prefix,
+                           NodeData *arr[], int size, int &index) const
+{
+    if(current == nullptr || index >= size)
+    {
+        return;
+    }
+    const string &key = current->data->getData();
+    // Key is in the range. Matches may be on both sides
+    if(key.compare(0, prefix.size(), prefix) == 0)
+    {
+        prefixHelper(current->left, prefix, arr, size, index);
+        if(index < size)
+        {
+            arr[index] = current->data;
+            index++;
+        }
+        prefixHelper(current->right, prefix, arr, size, index);
+    }
+    // Key is before the range. Go right
+    else if(key < prefix)
+    {
+        prefixHelper(current->right, prefix, arr, size, index);
+    }
+    // Key is after the range. Go left
+    else
+    {
+        prefixHelper(current->left, prefix, arr, size, index);
+    }
+}
+
+/*
+ * Finds the longest key in the tree that is a prefix of query
+ * and reports whether one was found.
+ * If found, pMatch will point to the actual object in the tree.
+ * If not found, it will not be changed.
+ * Any key that is a prefix of query sorts between itself and query,
+ * so it is also a prefix of the largest key <= query. When that
+ * largest key is not a prefix itself, the search repeats with the
+ * common prefix of the two, which is always shorter than query.
+ * Each step is one O(height) descent. There are at most
+ * query length + 1 steps, so the worst case is O(|query| * height)
+ * string compares. Usually one or two steps are needed.
+ */
+bool BinTree::longestPrefixMatch(const NodeData &query, NodeData *&pMatch) const
+{
+    const string &full = query.getData();
+    // Only the first length characters of query are searched for
+    size_t length = full.size();
+    for(;;)
+    {
+        Node* temp = floorHelper(root, full, length);
+        if(temp == nullptr)
+        {
+            return false;
+        }
+        const string &key = temp->data->getData();
+        if(key.size() <= length && full.compare(0, key.size(), key) == 0)
+        {
+            pMatch = temp->data;
+            return true;
+        }
+        // Shorten the query to what it has in common with key
+        size_t common = 0;
+        while(common < key.size() && common < length && key[common] == full[common])
+        {
+            common++;
+        }
+        length = common;
+    }
+}
+
+/*
+ * Helper function for longestPrefixMatch.
+ * Returns the Node with the largest data less than or equal to
+ * the first length characters of query. Returns a nullptr if every
+ * Node is greater. Compares in place so no target is allocated.
+ */
+BinTree::Node *BinTree::floorHelper(BinTree::Node *current, const std::string &query,
+                                    size_t length) const
+{
+    if(current == nullptr)
+    {
+        return nullptr;
+    }
+    // Current is too large. Answer is on the left
+    if(current->data->getData().compare(0, string::npos, query, 0, length) > 0)
+    {
+        return floorHelper(current->left, query, length);
+    }
+    // Current is a candidate. A larger one may be on the right
+    Node* better = floorHelper(current->right, query, length);
+    return (better != nullptr ? better : current);
+}
+
 /*
  * Displays a binary tree as though you are viewing it from the side;
  * hard coded displaying to standard output.
@@ -400,7 +567,24 @@ int BinTree::heightHelper(const Node* current) const
  */
 void BinTree::displaySideways() const
 {
-    sideways(root, 0);
+    displaySideways(cout);
+}
+
+/*
+ * Displays a binary tree sideways to any output stream.
+ * Lines are formatted into a buffer that is written in large chunks
+ * and the stream is flushed once at the end.
+ * When maxDepth is positive only the top maxDepth levels are shown;
+ * a cut off subtree is shown as "..." one level deeper.
+ * Preconditions: NONE
+ * Postconditions: BinTree remains unchanged.
+ */
+void BinTree::displaySideways(std::ostream &outStream, int maxDepth) const
+{
+    string &buffer = renderBuffer();
+    sideways(root, 0, maxDepth, buffer, outStream);
+    writeBuffer(buffer, outStream, 0);
+    outStream.flush();
 }
 
 
@@ -409,19 +593,26 @@ void BinTree::displaySideways() const
  * Preconditions: NONE
  * Postconditions: BinTree remains unchanged.
  */
-void BinTree::sideways(BinTree::Node *current, int level) const
+void BinTree::sideways(const BinTree::Node *current, int level, int maxDepth,
+                       std::string &buffer, std::ostream &outStream) const
 {
     if (current != nullptr)
     {
         level++;
-        sideways(current->right, level);
         // indent for readability, 4 spaces per depth level
-        for (int i = level; i >= 0; i--)
+        if (maxDepth > 0 && level > maxDepth)
         {
-            cout << "    ";
+            buffer.append(static_cast<size_t>(level + 1) * 4, ' ');
+            buffer += "...\n";
+            writeBuffer(buffer, outStream, RENDER_CHUNK);
+            return;
         }
-        cout << *current->data << endl;        // display information of object
-        sideways(current->left, level);
+        sideways(current->right, level, maxDepth, buffer, outStream);
+        buffer.append(static_cast<size_t>(level + 1) * 4, ' ');
+        buffer += current->data->getData();        // display information of object
+        buffer += '\n';
+        writeBuffer(buffer, outStream, RENDER_CHUNK);
+        sideways(current->left, level, maxDepth, buffer, outStream);
     }
 }
 
@@ -437,6 +628,11 @@ BinTree &BinTree::operator=(const BinTree &b)
         return *this;
     }
     makeEmpty();
+    // Assigning an empty tree
+    if(b.root == nullptr)
+    {
+        return *this;
+    }
     root = new Node;
     root->left = nullptr;
     root->right = nullptr;
@@ -18,6 +18,7 @@
 #include "nodedata.h"
 #include <iostream>
 #include <fstream>
+#include <string>
 class BinTree
 {
     friend std::ostream& operator<<(std::ostream &outStream, const BinTree &b);
@@ -28,6 +29,7 @@ public:
     ~BinTree();
 
     void bstreeToArray(NodeData* arr[]);
+    void bstreeToArray(NodeData* arr[], int &index);
     void arrayToBSTree(NodeData* arr[]);
 
     bool isEmpty() const;
@@ -35,7 +37,11 @@ public:
     bool retrieve(const NodeData &target, NodeData* &pTarget);
     bool insert(NodeData* item);
     int getHeight(const NodeData &n) const;
+    int prefixRange(const NodeData &prefix, NodeData* arr[], int size) const;
+    bool longestPrefixMatch(const NodeData &query, NodeData* &pMatch) const;
+    void displayInorder(std::ostream &outStream) const;
     void displaySideways() const;
+    void displaySideways(std::ostream &outStream, int maxDepth = 0) const;
 
     // Overload operators
     BinTree& operator=(const BinTree &b);
@@ -52,6 +58,9 @@ private:
     };
     Node* root;
 
+    // Rendering buffers are written out once they reach this many characters
+    static const size_t RENDER_CHUNK = 64 * 1024;
+
     // Utility functions
     void inorderHelper(Node* current, int &index, NodeData* arr[]) const;
     Node* arrayToBSTHelper(int low, int high, NodeData* arr[]);
@@ -59,9 +68,15 @@ private:
     void deleteHelper(Node* current);
     Node* retrieveHelper(Node* current, const NodeData &target) const;
     int heightHelper(const Node* current) const;
+    void prefixHelper(const Node* current, const std::string &prefix,
+                      NodeData* arr[], int size, int &index) const;
+    Node* floorHelper(Node* current, const std::string &query, size_t length) const;
     bool insertHelper(Node* current, NodeData* item);
     bool equalityHelper(const Node* current, const Node* other) const;
-    void sideways(Node* current, int level) const;
-    void coutHelper(std::ostream &outStream, const Node* current) const;
+    void sideways(const Node* current, int level, int maxDepth,
+                  std::string &buffer, std::ostream &outStream) const;
+    void coutHelper(const Node* current, std::string &buffer, std::ostream &outStream) const;
+    static std::string& renderBuffer();
+    static void writeBuffer(std::string &buffer, std::ostream &outStream, size_t limit);
 };
 #endif //ASSIGNMENT2_BINTREE_H
@@ -0,0 +1,22 @@
+#include "driverutil.h"
+#include <cstdlib>
+#include <iostream>
+
+//------------------------------- readCount ----------------------------------
+bool readCount(int argc, char* argv[], int index, int fallback, int& count) {
+	count = fallback;
+	if (argc <= index)
+		return true;
+	char* end;
+	long value = strtol(argv[index], &end, 10);
+	if (*end != '\0' || value <= 0 || value > 100000000)
+		return false;
+	count = static_cast<int>(value);
+	return true;
+}
+
+//------------------------------- report -------------------------------------
+bool report(const string& name, bool result) {
+	cout << name << (result ? "passed" : "FAILED") << endl;
+	return result;
+}
@@ -0,0 +1,17 @@
+// Helpers shared by the command line drivers (sharddriver, prefixdriver,
+// renderdriver and lab2batch).
+
+#ifndef DRIVERUTIL_H
+#define DRIVERUTIL_H
+#include <string>
+using namespace std;
+
+// reads argv[index] as a positive count, or uses fallback when it was not
+// given; returns false if the argument is not a positive integer
+bool readCount(int argc, char* argv[], int index, int fallback, int& count);
+
+// prints one check's result after name and returns the result;
+// name should include its own padding, e.g. "Routing:       "
+bool report(const string& name, bool result);
+
+#endif
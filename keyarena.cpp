@@ -0,0 +1,46 @@
+// ------------- keyarena.cpp -----------------------------------------------
+// Jarod Guerrero CSS ThreeFourThree C
+// -------------------------------------------------------------------------
+// Key Arena implementation file
+// -------------------------------------------------------------------------
+// Keys are only ever added, never removed, so a pointer returned by
+// intern stays valid for the life of the arena.
+// -------------------------------------------------------------------------
+
+#include "keyarena.h"
+
+using namespace std;
+
+/*
+ * Default constructor creates an empty arena.
+ */
+KeyArena::KeyArena()
+{
+}
+
+/*
+ * Destructor. Every interned key is released, so no NodeData
+ * may still refer to this arena.
+ */
+KeyArena::~KeyArena()
+{
+}
+
+/*
+ * Returns the arena's single copy of a key, storing the key
+ * first if it has not been interned before.
+ */
+const std::string *KeyArena::intern(const std::string &key)
+{
+    lock_guard<mutex> guard(lock);
+    return &*keys.insert(key).first;
+}
+
+/*
+ * Returns the number of distinct keys stored.
+ */
+int KeyArena::size() const
+{
+    lock_guard<mutex> guard(lock);
+    return static_cast<int>(keys.size());
+}
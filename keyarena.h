@@ -0,0 +1,44 @@
+// ------------- keyarena.h -------------------------------------------------
+// Jarod Guerrero CSS ThreeFourThree C
+// -------------------------------------------------------------------------
+// Key Arena header file
+// -------------------------------------------------------------------------
+// An append-only pool of interned key strings. Each distinct key is
+// stored once and keeps the same address until the arena is destroyed,
+// so interned NodeData can hold a pointer to it instead of a copy.
+// Copying an interned NodeData copies the pointer, not the key bytes.
+// The arena must outlive every NodeData that refers to it.
+// Interning is safe from several threads at once.
+// Keys are kept in a hash set rather than in chunked character blocks,
+// because NodeData hands out keys as const std::string&. Each distinct
+// key costs one set node holding a std::string (64 byte heap block), a
+// bucket pointer, and a heap buffer when the key is over 15 characters:
+// about 78 bytes for an 8 character key and 158 for a 64 character key.
+// -------------------------------------------------------------------------
+
+#ifndef ASSIGNMENT2_KEYARENA_H
+#define ASSIGNMENT2_KEYARENA_H
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+class KeyArena
+{
+public:
+    KeyArena();
+    ~KeyArena();
+
+    const std::string* intern(const std::string &key);
+    int size() const;
+
+private:
+    // Not copyable, NodeData point into the arena
+    KeyArena(const KeyArena &k);
+    KeyArena& operator=(const KeyArena &k);
+
+    // Node based, so element addresses survive rehashing
+    std::unordered_set<std::string> keys;
+    mutable std::mutex lock;
+};
+#endif //ASSIGNMENT2_KEYARENA_H
@@ -0,0 +1,200 @@
+// Batch driver for the same $$-segmented input format lab2.cpp reads.
+// Each segment is an independent tree, so segments are built and tested
+// concurrently on a pool of worker threads.
+
+// Unlike lab2.cpp, no tree carries over from one segment to the next.
+// lab2.cpp builds first and dup from the first segment only, so its
+// "T != first?" and "T == dup?" lines compare later segments against
+// older trees. Here first and dup are copies of the segment's own tree,
+// so those lines always print "equal". lab2.cpp also prints an extra
+// empty "Initial data:" block after the last segment; this driver does not.
+
+// Usage: lab2batch [data file] [thread count] [-t]
+// The data file defaults to data2.txt and the thread count defaults to
+// the number of hardware threads. The thread count must be a positive
+// integer and is capped at the number of segments.
+// With -t nothing is printed per segment. Instead the segments are
+// processed once on 1 thread and once on thread count threads, and both
+// times are printed.
+
+// Every segment renders into its own string. Nothing touches the console
+// until all workers are done, then the strings are written in input
+// order, so the output is the same for any thread count.
+// A trailing segment without a closing $$ is ignored, as in lab2.cpp.
+
+// Keys are interned into one KeyArena while the file is read, and each
+// segment keeps interned NodeData. Every tree, copy and array built from
+// them copies the arena pointer, so a key's bytes are stored once.
+
+#include "bintree.h"
+#include "driverutil.h"
+#include "keyarena.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+//global function prototypes
+bool readSegments(vector<vector<NodeData> >&, KeyArena&, const string&);
+void processSegment(const vector<NodeData>&, string&);
+void runPool(const vector<vector<NodeData> >&, vector<string>&, size_t);
+double timePool(const vector<vector<NodeData> >&, size_t);
+
+int main(int argc, char* argv[]) {
+	string fileName = (argc > 1 ? argv[1] : "data2.txt");
+	KeyArena arena;
+	vector<vector<NodeData> > segments;
+	if (!readSegments(segments, arena, fileName)) {
+		cout << "File could not be opened." << endl;
+		return 1;
+	}
+
+	int requested;
+	if (!readCount(argc, argv, 2, max(1u, thread::hardware_concurrency()), requested)) {
+		cout << "Thread count must be a positive integer." << endl;
+		return 1;
+	}
+	size_t threadCount = static_cast<size_t>(requested);
+	if (threadCount > segments.size())
+		threadCount = segments.size();
+
+	if (argc > 3 && string(argv[3]) == "-t") {
+		cout << segments.size() << " segments, " << thread::hardware_concurrency()
+			<< " hardware threads" << endl;
+		cout << "  1 thread:   " << timePool(segments, 1) << " s" << endl;
+		cout << "  " << threadCount << " threads: " << timePool(segments, threadCount)
+			<< " s" << endl;
+		return 0;
+	}
+
+	vector<string> results(segments.size());
+	runPool(segments, results, threadCount);
+
+	// write every result in input order
+	for (size_t i = 0; i < results.size(); i++) {
+		if (i > 0) {
+			cout << "---------------------------------------------------------------"
+				<< '\n';
+		}
+		cout.write(results[i].data(), results[i].size());
+	}
+	cout.flush();
+	return 0;
+}
+
+//------------------------------- runPool ------------------------------------
+// Processes every segment on threadCount threads. Workers claim the next
+// unprocessed segment until none are left; results[i] gets segment i's
+// report.
+
+void runPool(const vector<vector<NodeData> >& segments,
+		vector<string>& results, size_t threadCount) {
+	atomic<size_t> next(0);
+	vector<thread> pool;
+	for (size_t t = 0; t < threadCount; t++) {
+		pool.push_back(thread([&]() {
+			for (size_t i = next++; i < segments.size(); i = next++)
+				processSegment(segments[i], results[i]);
+		}));
+	}
+	for (size_t t = 0; t < pool.size(); t++)
+		pool[t].join();
+}
+
+//------------------------------- timePool -----------------------------------
+// Returns the seconds runPool takes on threadCount threads, not counting
+// reading the file or writing the results.
+
+double timePool(const vector<vector<NodeData> >& segments, size_t threadCount) {
+	vector<string> results(segments.size());
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	runPool(segments, results, threadCount);
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+//------------------------------- readSegments -------------------------------
+// Reads every whitespace separated string from the file, starting a new
+// segment after each "$$". Each string becomes a NodeData interned into
+// arena.
+// Returns false if the file could not be opened.
+
+bool readSegments(vector<vector<NodeData> >& segments, KeyArena& arena,
+		const string& fileName) {
+	ifstream infile(fileName.c_str());
+	if (!infile)
+		return false;
+	vector<NodeData> current;
+	string s;
+	while (infile >> s) {
+		if (s == "$$") {
+			segments.push_back(vector<NodeData>());
+			segments.back().swap(current);
+		}
+		else {
+			current.push_back(NodeData(s, arena));
+		}
+	}
+	return true;
+}
+
+//------------------------------- processSegment -----------------------------
+// Runs the lab2.cpp tests on one segment's tree, writing the report into
+// out instead of the console. The layout matches lab2.cpp, but first and
+// dup are copies of this segment's tree rather than of the first
+// segment's, so the != first and == dup lines always report "equal".
+
+void processSegment(const vector<NodeData>& keys, string& out) {
+	ostringstream os;
+	BinTree T, T2, dup;
+
+	// build the tree, echoing the segment
+	os << "Initial data:" << '\n' << "  ";
+	for (size_t i = 0; i < keys.size(); i++) {
+		os << keys[i] << ' ';
+		NodeData* ptr = new NodeData(keys[i]);
+		if (!T.insert(ptr))
+			delete ptr;                       // duplicate case, not inserted
+	}
+	os << "$$ " << '\n';
+	BinTree first(T);                  // test copy constructor
+	dup = T;                           // test operator=
+
+	os << "Tree Inorder:" << '\n' << T;
+	T.displaySideways(os);
+
+	// test retrieve
+	const char* probes[] = { "and", "not", "sss" };
+	NodeData* p;
+	for (int i = 0; i < 3; i++) {
+		bool found = T.retrieve(NodeData(probes[i]), p);
+		os << "Retrieve --> " << probes[i] << ":  "
+			<< (found ? "found" : "not found") << '\n';
+	}
+
+	// test getHeight
+	const char* heights[] = { "and", "not", "sss", "tttt", "ooo", "y" };
+	for (int i = 0; i < 6; i++) {
+		os << "Height    --> " << heights[i] << ":  "
+			<< T.getHeight(NodeData(heights[i])) << '\n';
+	}
+
+	// test ==, and !=
+	T2 = T;
+	os << "T == T2?     " << (T == T2 ? "equal" : "not equal") << '\n';
+	os << "T != first?  " << (T != first ? "not equal" : "equal") << '\n';
+	os << "T == dup?    " << (T == dup ? "equal" : "not equal") << '\n';
+
+	// somewhat test bstreeToArray and arrayToBSTree
+	vector<NodeData*> ndArray(keys.size() + 1, nullptr);
+	T.bstreeToArray(&ndArray[0]);
+	T.arrayToBSTree(&ndArray[0]);
+	T.displaySideways(os);
+
+	out = os.str();
+}
@@ -1,58 +1,71 @@
 #include "nodedata.h"
+#include "keyarena.h"
 
 //------------------- constructors/destructor  -------------------------------
-NodeData::NodeData() { data = ""; }                         // default
+NodeData::NodeData() { data = ""; interned = nullptr; }     // default
 
 NodeData::~NodeData() { }            // needed so strings are deleted properly
 
-NodeData::NodeData(const NodeData& nd) { data = nd.data; }  // copy
+NodeData::NodeData(const NodeData& nd) {                    // copy
+	data = nd.data;                   // empty when nd is interned
+	interned = nd.interned;
+}
+
+NodeData::NodeData(const string& s) { data = s; interned = nullptr; } // cast string to NodeData
 
-NodeData::NodeData(const string& s) { data = s; }    // cast string to NodeData
+NodeData::NodeData(const string& s, KeyArena& arena) { interned = arena.intern(s); }
 
 //------------------------- operator= ----------------------------------------
 NodeData& NodeData::operator=(const NodeData& rhs) {
 	if (this != &rhs) {
 		data = rhs.data;
+		interned = rhs.interned;
 	}
 	return *this;
 }
 
 //------------------------- operator==,!= ------------------------------------
+// keys from the same arena are equal exactly when the pointers are equal
 bool NodeData::operator==(const NodeData& rhs) const {
-	return data == rhs.data;
+	if (interned == nullptr && rhs.interned == nullptr)
+		return data == rhs.data;
+	if (interned == rhs.interned)
+		return true;
+	return getData() == rhs.getData();
 }
 
 bool NodeData::operator!=(const NodeData& rhs) const {
-	return data != rhs.data;
+	return !(*this == rhs);
 }
 
 //------------------------ operator<,>,<=,>= ---------------------------------
 bool NodeData::operator<(const NodeData& rhs) const {
-	return data < rhs.data;
+	return getData() < rhs.getData();
 }
 
 bool NodeData::operator>(const NodeData& rhs) const {
-	return data > rhs.data;
+	return getData() > rhs.getData();
 }
 
 bool NodeData::operator<=(const NodeData& rhs) const {
-	return data <= rhs.data;
+	return getData() <= rhs.getData();
 }
 
 bool NodeData::operator>=(const NodeData& rhs) const {
-	return data >= rhs.data;
+	return getData() >= rhs.getData();
 }
 
 //------------------------------ setData -------------------------------------
 // returns true if the data is set, false when bad data, i.e., is eof
 
 bool NodeData::setData(istream& infile) {
+	interned = nullptr;               // data read in is always owned
 	getline(infile, data);
 	return !infile.eof();       // eof function is true when eof char is read
 }
 
 //-------------------------- operator<< --------------------------------------
 ostream& operator<<(ostream& output, const NodeData& nd) {
-	output << nd.data;
+	output << nd.getData();
 	return output;
 }
@@ -5,6 +5,8 @@
 #include <fstream>
 using namespace std;
 
+class KeyArena;
+
 // simple class containing one string to use for testing
 // not necessary to comment further
 
@@ -16,12 +18,18 @@ public:
 	~NodeData();
 	NodeData(const string &);      // data is set equal to parameter
 	NodeData(const NodeData &);    // copy constructor
+
+	// interned mode, the key lives in a KeyArena and is not copied
+	NodeData(const string &, KeyArena &);   // interns the parameter
 	NodeData& operator=(const NodeData &);
 
 	// set class data from data file
 	// returns true if the data is set, false when bad data, i.e., is eof
 	bool setData(istream&);
 
+	// read only access to the key, used for formatting without an ostream
+	const string& getData() const { return interned != nullptr ? *interned : data; }
+
 	bool operator==(const NodeData &) const;
 	bool operator!=(const NodeData &) const;
 	bool operator<(const NodeData &) const;
@@ -30,7 +38,11 @@ public:
 	bool operator>=(const NodeData &) const;
 
 private:
-	string data;
+	// owned keys are stored in data exactly as before. An interned key
+	// leaves data empty and points into its KeyArena; copies copy the
+	// pointer, so the key bytes are never copied
+	string data;              // owned key, empty when interned
+	const string* interned;   // key in a KeyArena, nullptr when owned
 };
 
 #endif
@@ -0,0 +1,178 @@
+// Driver for BinTree::prefixRange and BinTree::longestPrefixMatch.
+// First checks edge cases on small hand built trees, then compares both
+// queries against a linear scan over every key of a large tree, checking
+// the answers agree and timing each side.
+
+// Usage: prefixdriver [key count] [query count]
+// Defaults are 200000 keys and 2000 queries.
+
+// Keys are pseudo random strings over a small alphabet with a fixed
+// seed, so many keys share prefixes and every run uses the same keys.
+// Duplicate keys are dropped, so the tree may hold fewer than key count.
+// Prints one line per check and returns 1 if any check fails.
+
+#include "bintree.h"
+#include "driverutil.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+//global function prototypes
+void buildTree(BinTree&, const vector<string>&);
+string listRange(const BinTree&, const string&, int);
+string matchOf(const BinTree&, const string&);
+string randomKey(mt19937&, int);
+
+int main(int argc, char* argv[]) {
+	int keyCount, queryCount;
+	if (!readCount(argc, argv, 1, 200000, keyCount) ||
+		!readCount(argc, argv, 2, 2000, queryCount)) {
+		cout << "Counts must be positive integers." << endl;
+		return 1;
+	}
+	bool passed = true;
+
+	// edge cases
+	BinTree T;
+	buildTree(T, { "ab", "abc", "abyy", "b", "ba" });
+	passed &= report("Empty prefix:          ",
+		listRange(T, "", 10) == "ab abc abyy b ba ");
+	passed &= report("Prefix range:          ", listRange(T, "ab", 10) == "ab abc abyy ");
+	passed &= report("Truncated at size:     ", listRange(T, "ab", 2) == "ab abc ");
+	passed &= report("Prefix with no keys:   ", listRange(T, "c", 10) == "");
+	passed &= report("No match:              ", matchOf(T, "zzz") == "not found");
+	passed &= report("Query shorter:         ", matchOf(T, "a") == "not found");
+	passed &= report("Exact match:           ", matchOf(T, "abc") == "abc");
+	passed &= report("Multi step shortening: ", matchOf(T, "abz") == "ab");
+
+	BinTree E;
+	buildTree(E, { "", "m", "mo" });
+	passed &= report("Empty string key:      ", matchOf(E, "zzz") == "");
+	passed &= report("Empty key in range:    ", listRange(E, "", 10) == " m mo ");
+	passed &= report("Longest of several:    ", matchOf(E, "mop") == "mo");
+
+	BinTree empty;
+	passed &= report("Empty tree:            ",
+		matchOf(empty, "a") == "not found" && listRange(empty, "", 10) == "");
+
+	// large tree against a linear scan
+	mt19937 generator(343);
+	vector<string> keys(keyCount);
+	for (int i = 0; i < keyCount; i++)
+		keys[i] = randomKey(generator, 16);
+	// the tree skips duplicates, so the scan must too
+	sort(keys.begin(), keys.end());
+	keys.erase(unique(keys.begin(), keys.end()), keys.end());
+	keyCount = static_cast<int>(keys.size());
+	shuffle(keys.begin(), keys.end(), generator);
+	BinTree big;
+	buildTree(big, keys);
+	vector<string> queries(queryCount);
+	for (int i = 0; i < queryCount; i++)
+		queries[i] = randomKey(generator, 18);
+
+	// prefixRange costs O(height + matches), so it is timed separately from
+	// longestPrefixMatch and the average number of matches is reported.
+	// A short prefix matching most of the tree gains little over a scan.
+	vector<NodeData*> found(keyCount);
+	bool agree = true;
+	double rangeSeconds = 0, rangeScanSeconds = 0;
+	double matchSeconds = 0, matchScanSeconds = 0;
+	long totalMatches = 0;
+	for (int q = 0; q < queryCount && agree; q++) {
+		const string& query = queries[q];
+		// prefixes of exactly 4 to 10 characters
+		string prefix;
+		for (int length = 4 + generator() % 7; length > 0; length--)
+			prefix += static_cast<char>('a' + generator() % 4);
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		int count = big.prefixRange(NodeData(prefix), &found[0], keyCount);
+		chrono::steady_clock::time_point middle = chrono::steady_clock::now();
+		int scanCount = 0;
+		for (int i = 0; i < keyCount; i++) {
+			if (keys[i].compare(0, prefix.size(), prefix) == 0)
+				scanCount++;
+		}
+		chrono::steady_clock::time_point end = chrono::steady_clock::now();
+		rangeSeconds += chrono::duration<double>(middle - start).count();
+		rangeScanSeconds += chrono::duration<double>(end - middle).count();
+		totalMatches += count;
+
+		start = chrono::steady_clock::now();
+		NodeData* match = nullptr;
+		bool matched = big.longestPrefixMatch(NodeData(query), match);
+		middle = chrono::steady_clock::now();
+		const string* scanMatch = nullptr;
+		for (int i = 0; i < keyCount; i++) {
+			const string& key = keys[i];
+			if (query.compare(0, key.size(), key) == 0 &&
+				(scanMatch == nullptr || key.size() > scanMatch->size()))
+				scanMatch = &key;
+		}
+		end = chrono::steady_clock::now();
+		matchSeconds += chrono::duration<double>(middle - start).count();
+		matchScanSeconds += chrono::duration<double>(end - middle).count();
+
+		agree = (count == scanCount) && (matched == (scanMatch != nullptr))
+			&& (!matched || match->getData() == *scanMatch);
+	}
+	passed &= report("Agrees with scan:      ", agree);
+	cout << "Keys in tree:          " << keyCount << endl;
+	cout << "Average range matches: "
+		<< static_cast<double>(totalMatches) / queryCount << endl;
+	cout << "prefixRange:           " << rangeSeconds << " s, scan "
+		<< rangeScanSeconds << " s" << endl;
+	cout << "longestPrefixMatch:    " << matchSeconds << " s, scan "
+		<< matchScanSeconds << " s" << endl;
+
+	return passed ? 0 : 1;
+}
+
+//------------------------------- buildTree ----------------------------------
+// Inserts each key, skipping duplicates, the same way lab2.cpp does.
+
+void buildTree(BinTree& T, const vector<string>& keys) {
+	for (size_t i = 0; i < keys.size(); i++) {
+		NodeData* ptr = new NodeData(keys[i]);
+		if (!T.insert(ptr))
+			delete ptr;                       // duplicate case, not inserted
+	}
+}
+
+//------------------------------- listRange ----------------------------------
+// Returns the keys prefixRange finds, each followed by a space.
+
+string listRange(const BinTree& T, const string& prefix, int size) {
+	vector<NodeData*> arr(size);
+	int count = T.prefixRange(NodeData(prefix), &arr[0], size);
+	string result;
+	for (int i = 0; i < count; i++)
+		result += arr[i]->getData() + " ";
+	return result;
+}
+
+//------------------------------- matchOf ------------------------------------
+// Returns the key longestPrefixMatch finds, or "not found".
+
+string matchOf(const BinTree& T, const string& query) {
+	NodeData* match = nullptr;
+	if (!T.longestPrefixMatch(NodeData(query), match))
+		return "not found";
+	return match->getData();
+}
+
+//------------------------------- randomKey ----------------------------------
+// Returns a string of up to maxLength characters from 'a' to 'd'.
+
+string randomKey(mt19937& generator, int maxLength) {
+	string key;
+	int length = static_cast<int>(generator() % (maxLength + 1));
+	for (int i = 0; i < length; i++)
+		key += static_cast<char>('a' + generator() % 4);
+	return key;
+}
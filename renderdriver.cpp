@@ -0,0 +1,177 @@
+// Driver for the buffered operator<< and displaySideways. First checks
+// the depth limited view on a small tree, then times dumping a large
+// balanced tree to a file with the buffered renderers and with the old
+// way of writing, one ostream call per key or indent and endl per line.
+
+// Usage: renderdriver [key count]
+// Default is 1000000 keys.
+
+// The old way is replayed from the buffered output: the same bytes are
+// written with the same calls the old coutHelper and sideways made, so
+// both sides produce identical files. The file, renderdriver.tmp, is
+// written in the working directory and removed at the end.
+// Prints one line per check and timing, and returns 1 if any check fails.
+
+#include "bintree.h"
+#include "driverutil.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+//global function prototypes
+string sidewaysOf(const BinTree&, int);
+void oldInorder(ostream&, const string&, size_t);
+void oldSideways(ostream&, const string&, size_t);
+double timeToFile(const char*, void (*)(ostream&, const BinTree&, const string&),
+	const BinTree&, const string&);
+void newDump(ostream&, const BinTree&, const string&);
+void oldDump(ostream&, const BinTree&, const string&);
+
+int main(int argc, char* argv[]) {
+	int keyCount;
+	if (!readCount(argc, argv, 1, 1000000, keyCount)) {
+		cout << "Key count must be a positive integer." << endl;
+		return 1;
+	}
+	bool passed = true;
+
+	// depth limited view, tree is   m
+	//                            f     t
+	//                          a   h     z
+	BinTree T;
+	const char* small[] = { "m", "f", "t", "a", "h", "z" };
+	for (int i = 0; i < 6; i++)
+		T.insert(new NodeData(small[i]));
+	string full =
+		"                z\n"
+		"            t\n"
+		"        m\n"
+		"                h\n"
+		"            f\n"
+		"                a\n";
+	passed &= report("No limit:           ", sidewaysOf(T, 0) == full);
+	passed &= report("Negative limit:     ", sidewaysOf(T, -3) == full);
+	passed &= report("Limit past height:  ", sidewaysOf(T, 5) == full);
+	passed &= report("Limit of 2:         ", sidewaysOf(T, 2) ==
+		"                ...\n"
+		"            t\n"
+		"        m\n"
+		"                ...\n"
+		"            f\n"
+		"                ...\n");
+	passed &= report("Limit of 1:         ", sidewaysOf(T, 1) ==
+		"            ...\n"
+		"        m\n"
+		"            ...\n");
+	ostringstream inorder;
+	inorder << T;
+	passed &= report("Inorder:            ", inorder.str() == "a f h m t z \n");
+
+	BinTree empty;
+	ostringstream emptyInorder;
+	emptyInorder << empty;
+	passed &= report("Empty tree:         ", sidewaysOf(empty, 0) == "" &&
+		sidewaysOf(empty, 2) == "" && emptyInorder.str() == "\n");
+
+	// large balanced tree
+	vector<NodeData*> arr(keyCount + 1, nullptr);
+	for (int i = 0; i < keyCount; i++) {
+		char key[16];
+		snprintf(key, sizeof(key), "%09d", i);
+		arr[i] = new NodeData(key);
+	}
+	BinTree big;
+	big.arrayToBSTree(&arr[0]);
+	ostringstream expected;
+	newDump(expected, big, "");
+	string text = expected.str();
+
+	double newSeconds = timeToFile("renderdriver.tmp", newDump, big, text);
+	ifstream newFile("renderdriver.tmp", ios::binary);
+	string newText((istreambuf_iterator<char>(newFile)), istreambuf_iterator<char>());
+	newFile.close();
+	double oldSeconds = timeToFile("renderdriver.tmp", oldDump, big, text);
+	ifstream oldFile("renderdriver.tmp", ios::binary);
+	string oldText((istreambuf_iterator<char>(oldFile)), istreambuf_iterator<char>());
+	oldFile.close();
+	remove("renderdriver.tmp");
+	passed &= report("Same file:          ", newText == text && oldText == text);
+
+	cout << "Dump " << keyCount << " keys, " << text.size() << " bytes:" << endl;
+	cout << "  buffered:  " << newSeconds << " s" << endl;
+	cout << "  per line:  " << oldSeconds << " s" << endl;
+	return passed ? 0 : 1;
+}
+
+//------------------------------- sidewaysOf ---------------------------------
+// Returns what displaySideways writes with the given depth limit.
+
+string sidewaysOf(const BinTree& T, int maxDepth) {
+	ostringstream out;
+	T.displaySideways(out, maxDepth);
+	return out.str();
+}
+
+//------------------------------- newDump ------------------------------------
+// Writes the tree inorder then sideways with the buffered renderers.
+
+void newDump(ostream& out, const BinTree& T, const string&) {
+	out << T;
+	T.displaySideways(out);
+}
+
+//------------------------------- oldDump ------------------------------------
+// Writes the same bytes as newDump, replayed from text with one ostream
+// call per key, separator and indent and an endl per line, as the old
+// coutHelper and sideways did.
+
+void oldDump(ostream& out, const BinTree&, const string& text) {
+	size_t lineEnd = text.find('\n');
+	oldInorder(out, text, lineEnd);
+	oldSideways(out, text, lineEnd + 1);
+}
+
+//------------------------------- oldInorder ---------------------------------
+// Writes each space separated key before text[lineEnd] then " ", then endl.
+
+void oldInorder(ostream& out, const string& line, size_t lineEnd) {
+	size_t start = 0;
+	for (size_t space = line.find(' '); space < lineEnd;
+			space = line.find(' ', start)) {
+		out.write(line.data() + start, space - start) << " ";
+		start = space + 1;
+	}
+	out << endl;
+}
+
+//------------------------------- oldSideways --------------------------------
+// Writes each line from lines[start] on: its indent 4 spaces at a time,
+// then its key and endl.
+
+void oldSideways(ostream& out, const string& lines, size_t start) {
+	while (start < lines.size()) {
+		size_t end = lines.find('\n', start);
+		size_t key = lines.find_first_not_of(' ', start);
+		for (size_t i = start; i < key; i += 4)
+			out << "    ";
+		out.write(lines.data() + key, end - key) << endl;
+		start = end + 1;
+	}
+}
+
+//------------------------------- timeToFile ---------------------------------
+// Returns the seconds dump takes writing into a new file.
+
+double timeToFile(const char* fileName, void (*dump)(ostream&, const BinTree&, const string&),
+		const BinTree& T, const string& text) {
+	ofstream out(fileName, ios::binary);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	dump(out, T, text);
+	out.close();
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
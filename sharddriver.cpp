@@ -0,0 +1,158 @@
+// Driver for ShardedBinTree. Inserts the same keys into a ShardedBinTree
+// from several threads at once and, after those threads finish, into a
+// single BinTree, then checks that both trees give the same answers.
+// Then times inserting every key at 1 and at thread count threads, into
+// a ShardedBinTree and into a single BinTree guarded by one mutex.
+
+// Usage: sharddriver [key count] [thread count] [shard count]
+// Defaults are 100000 keys, 4 threads and 8 shards.
+
+// Keys are pseudo random with a fixed seed, so every run uses the same
+// keys, and some keys repeat to exercise duplicate inserts. Every 16th
+// key is used as the split point sample.
+// Prints one line per check and one per timing, and returns 1 if any
+// check fails. Timings only show scaling on a machine with several cores.
+
+#include "bintree.h"
+#include "driverutil.h"
+#include "shardedtree.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+//global function prototypes
+void insertAll(const vector<string>&, int, const function<bool(NodeData*)>&);
+double timeInserts(const vector<string>&, int, const function<bool(NodeData*)>&);
+
+int main(int argc, char* argv[]) {
+	int keyCount, threadCount, shardCount;
+	if (!readCount(argc, argv, 1, 100000, keyCount) ||
+		!readCount(argc, argv, 2, 4, threadCount) ||
+		!readCount(argc, argv, 3, 8, shardCount)) {
+		cout << "Counts must be positive integers." << endl;
+		return 1;
+	}
+
+	// fixed seed, keys drawn from a range smaller than keyCount repeat
+	mt19937 generator(343);
+	vector<string> keys(keyCount);
+	for (int i = 0; i < keyCount; i++)
+		keys[i] = to_string(generator() % (keyCount - keyCount / 4 + 1));
+
+	vector<NodeData*> sample;
+	for (int i = 0; i < keyCount; i += 16)
+		sample.push_back(new NodeData(keys[i]));
+	int sampleSize = static_cast<int>(sample.size());
+	ShardedBinTree sharded(&sample[0], sampleSize, shardCount);
+	insertAll(keys, threadCount, [&](NodeData* ptr) { return sharded.insert(ptr); });
+	// reference tree, built only after every writer has finished
+	BinTree single;
+	insertAll(keys, 1, [&](NodeData* ptr) { return single.insert(ptr); });
+
+	bool passed = true;
+	cout << "Shards used: " << sharded.getShardCount() << endl;
+
+	// every key lands in the shard that owns it
+	bool routed = true;
+	for (int i = 0; i < keyCount && routed; i++) {
+		NodeData* p;
+		NodeData target(keys[i]);
+		routed = sharded.shard(sharded.shardFor(target)).retrieve(target, p);
+	}
+	passed &= report("Routing:       ", routed);
+
+	// retrieve finds the same object contents
+	bool retrieved = true;
+	for (int i = 0; i < keyCount && retrieved; i++) {
+		NodeData *p, *q;
+		NodeData target(keys[i]);
+		retrieved = sharded.retrieve(target, p) && single.retrieve(target, q)
+			&& *p == *q;
+	}
+	passed &= report("Retrieve:      ", retrieved);
+
+	ostringstream shardedOut, singleOut;
+	shardedOut << sharded;
+	singleOut << single;
+	passed &= report("Inorder:       ", shardedOut.str() == singleOut.str());
+
+	// arrays hold every distinct key once, plus a nullptr terminator
+	vector<NodeData*> shardedArray(keyCount + 1, nullptr);
+	vector<NodeData*> singleArray(keyCount + 1, nullptr);
+	sharded.bstreeToArray(&shardedArray[0]);
+	single.bstreeToArray(&singleArray[0]);
+	bool sameArray = true;
+	for (int i = 0; i <= keyCount && sameArray; i++) {
+		if (shardedArray[i] == nullptr || singleArray[i] == nullptr)
+			sameArray = (shardedArray[i] == singleArray[i]);
+		else
+			sameArray = (*shardedArray[i] == *singleArray[i]);
+	}
+	passed &= report("bstreeToArray: ", sameArray);
+	passed &= report("Emptied:       ", sharded.isEmpty() && single.isEmpty());
+
+	for (int i = 0; i <= keyCount; i++) {
+		delete shardedArray[i];
+		delete singleArray[i];
+	}
+
+	// insert timings, each into a fresh, empty structure
+	cout << "Insert " << keyCount << " keys, " << thread::hardware_concurrency()
+		<< " hardware threads:" << endl;
+	int counts[] = { 1, threadCount };
+	for (int c = 0; c < (threadCount > 1 ? 2 : 1); c++) {
+		BinTree locked;
+		mutex lock;
+		double lockedSeconds = timeInserts(keys, counts[c], [&](NodeData* ptr) {
+			lock_guard<mutex> guard(lock);
+			return locked.insert(ptr);
+		});
+		ShardedBinTree timed(&sample[0], sampleSize, shardCount);
+		double shardedSeconds = timeInserts(keys, counts[c],
+			[&](NodeData* ptr) { return timed.insert(ptr); });
+		cout << "  " << counts[c] << " thread(s): locked BinTree " << lockedSeconds
+			<< " s, sharded " << shardedSeconds << " s" << endl;
+	}
+
+	for (size_t i = 0; i < sample.size(); i++)
+		delete sample[i];
+	return passed ? 0 : 1;
+}
+
+//------------------------------- insertAll ----------------------------------
+// Inserts every key through insert from threadCount threads. Thread t
+// inserts every threadCount'th key starting at t. Duplicates are deleted.
+
+void insertAll(const vector<string>& keys, int threadCount,
+		const function<bool(NodeData*)>& insert) {
+	vector<thread> writers;
+	int keyCount = static_cast<int>(keys.size());
+	for (int t = 0; t < threadCount; t++) {
+		writers.push_back(thread([&, t]() {
+			for (int i = t; i < keyCount; i += threadCount) {
+				NodeData* ptr = new NodeData(keys[i]);
+				if (!insert(ptr))
+					delete ptr;               // duplicate case, not inserted
+			}
+		}));
+	}
+	for (size_t t = 0; t < writers.size(); t++)
+		writers[t].join();
+}
+
+//------------------------------- timeInserts --------------------------------
+// Returns the seconds insertAll takes.
+
+double timeInserts(const vector<string>& keys, int threadCount,
+		const function<bool(NodeData*)>& insert) {
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	insertAll(keys, threadCount, insert);
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
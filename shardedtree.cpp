@@ -0,0 +1,172 @@
+// ------------- shardedtree.cpp --------------------------------------------
+// Jarod Guerrero CSS ThreeFourThree C
+// -------------------------------------------------------------------------
+// Sharded Binary Search Tree implementation file
+// -------------------------------------------------------------------------
+// Keys are routed to a shard by binary searching the sorted split points.
+// A key equal to a split point belongs to the shard on its right, so
+// every shard holds a contiguous, non-overlapping range of keys and
+// shard i's keys are all less than shard i + 1's keys.
+// -------------------------------------------------------------------------
+
+#include "shardedtree.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+/*
+ * Outputs the contents of every shard in order, producing the same
+ * line that operator<< would for a single BinTree holding every key.
+ */
+std::ostream& operator<<(std::ostream &outStream, const ShardedBinTree &s)
+{
+    s.coutHelper(outStream);
+    outStream << endl;
+    return outStream;
+}
+
+/*
+ * Helper function for the cout operator. Outputs each shard's
+ * inorder contents, without a trailing endl.
+ */
+void ShardedBinTree::coutHelper(std::ostream &outStream) const
+{
+    for(int i = 0; i < shardCount; i++)
+    {
+        lock_guard<mutex> guard(shards[i].lock);
+        shards[i].tree.displayInorder(outStream);
+    }
+}
+
+/*
+ * Creates an empty sharded tree. Split points are chosen at evenly
+ * spaced positions of the sorted, de-duplicated sample so each shard
+ * covers a similar number of sampled keys.
+ * Precondition:  sample holds sampleSize valid NodeData pointers.
+ *                The sample is only read, never owned.
+ * Postcondition: Uses at most shardCount shards. Fewer are used when the
+ *                sample has fewer distinct keys than shardCount.
+ */
+ShardedBinTree::ShardedBinTree(NodeData *sample[], int sampleSize, int shardCount)
+{
+    static_assert(sizeof(Shard) % CACHE_LINE == 0, "Shard must fill whole cache lines");
+    vector<NodeData> sorted;
+    for(int i = 0; i < sampleSize; i++)
+    {
+        sorted.push_back(*sample[i]);
+    }
+    sort(sorted.begin(), sorted.end());
+    sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+
+    int distinct = static_cast<int>(sorted.size());
+    this->shardCount = max(1, min(shardCount, distinct));
+    shards = new Shard[this->shardCount];
+    splits = new NodeData[this->shardCount - 1];
+    for(int i = 1; i < this->shardCount; i++)
+    {
+        splits[i - 1] = sorted[static_cast<long long>(i) * distinct / this->shardCount];
+    }
+}
+
+/*
+ * Destructor. Each shard's BinTree deletes its own nodes.
+ */
+ShardedBinTree::~ShardedBinTree()
+{
+    delete[] shards;
+    delete[] splits;
+}
+
+/*
+ * Populates an array from every shard using inorder traversal.
+ * Shards are visited in key order so the resulting array is sorted.
+ * Leaves the tree empty.
+ */
+void ShardedBinTree::bstreeToArray(NodeData *arr[])
+{
+    int index = 0;
+    for(int i = 0; i < shardCount; i++)
+    {
+        lock_guard<mutex> guard(shards[i].lock);
+        shards[i].tree.bstreeToArray(arr, index);
+    }
+}
+
+/*
+ * Returns whether every shard is empty.
+ */
+bool ShardedBinTree::isEmpty() const
+{
+    for(int i = 0; i < shardCount; i++)
+    {
+        lock_guard<mutex> guard(shards[i].lock);
+        if(!shards[i].tree.isEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Empties every shard. The NodeData in each Node is also deleted.
+ */
+void ShardedBinTree::makeEmpty()
+{
+    for(int i = 0; i < shardCount; i++)
+    {
+        lock_guard<mutex> guard(shards[i].lock);
+        shards[i].tree.makeEmpty();
+    }
+}
+
+/*
+ * Retrieves the NodeData pointer of an object from the shard that
+ * owns its key. Behaves like BinTree::retrieve.
+ */
+bool ShardedBinTree::retrieve(const NodeData &target, NodeData *&pTarget)
+{
+    Shard &owner = shards[shardFor(target)];
+    lock_guard<mutex> guard(owner.lock);
+    return owner.tree.retrieve(target, pTarget);
+}
+
+/*
+ * Inserts an item into the shard that owns its key. Only that shard
+ * is locked, so inserts into other shards may run at the same time.
+ * Returns false if inserting an existing value, otherwise true.
+ */
+bool ShardedBinTree::insert(NodeData *item)
+{
+    Shard &owner = shards[shardFor(*item)];
+    lock_guard<mutex> guard(owner.lock);
+    return owner.tree.insert(item);
+}
+
+/*
+ * Returns the number of shards in use.
+ */
+int ShardedBinTree::getShardCount() const
+{
+    return shardCount;
+}
+
+/*
+ * Returns the index of the shard that owns a key.
+ * This is the number of split points less than or equal to the key.
+ */
+int ShardedBinTree::shardFor(const NodeData &key) const
+{
+    return static_cast<int>(upper_bound(splits, splits + shardCount - 1, key) - splits);
+}
+
+/*
+ * Returns a shard's BinTree without locking it. Lets a caller give
+ * each thread ownership of whole shards, with keys partitioned by
+ * shardFor, and insert without going through the locks.
+ */
+BinTree &ShardedBinTree::shard(int index)
+{
+    return shards[index].tree;
+}
@@ -0,0 +1,61 @@
+// ------------- shardedtree.h ----------------------------------------------
+// Jarod Guerrero CSS ThreeFourThree C
+// -------------------------------------------------------------------------
+// Sharded Binary Search Tree header file
+// -------------------------------------------------------------------------
+// Range-partitions the key space across K independent BinTrees. Split
+// points are taken from a sample of keys so each shard gets a similar
+// share of the data. Every shard has its own lock, so writers that land
+// in different shards can insert in parallel.
+// In-order output and bstreeToArray concatenate the shards, which are
+// already in key order.
+// -------------------------------------------------------------------------
+
+#ifndef ASSIGNMENT2_SHARDEDTREE_H
+#define ASSIGNMENT2_SHARDEDTREE_H
+
+#include "bintree.h"
+#include <mutex>
+
+class ShardedBinTree
+{
+    friend std::ostream& operator<<(std::ostream &outStream, const ShardedBinTree &s);
+
+public:
+    ShardedBinTree(NodeData* sample[], int sampleSize, int shardCount);
+    ~ShardedBinTree();
+
+    void bstreeToArray(NodeData* arr[]);
+
+    bool isEmpty() const;
+    void makeEmpty();
+    bool retrieve(const NodeData &target, NodeData* &pTarget);
+    bool insert(NodeData* item);
+
+    int getShardCount() const;
+    int shardFor(const NodeData &key) const;
+    BinTree& shard(int index);
+
+private:
+    // Not copyable, each shard owns a lock
+    ShardedBinTree(const ShardedBinTree &s);
+    ShardedBinTree& operator=(const ShardedBinTree &s);
+
+    // Shards are padded to a cache line so writers locking neighbouring
+    // shards do not fight over the same line
+    static const size_t CACHE_LINE = 64;
+    struct Shard
+    {
+        BinTree tree;
+        mutable std::mutex lock;
+        char padding[CACHE_LINE - (sizeof(BinTree) + sizeof(std::mutex)) % CACHE_LINE];
+    };
+    Shard* shards;
+    int shardCount;
+    // splits[i] is the smallest key routed to shards[i + 1]
+    NodeData* splits;
+
+    // Utility functions
+    void coutHelper(std::ostream &outStream) const;
+};
+#endif //ASSIGNMENT2_SHARDEDTREE_H